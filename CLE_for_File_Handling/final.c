@@ -1,10 +1,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <windows.h>
 #include <time.h>
 #include <direct.h>
 
+// Use SSE2 for the bulk scanning loops where the compiler targets it (always true on x64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // Define constants for different text colours
 #define COLOUR_ERROR 12 // Red colour for errors
 #define COLOUR_SUCCESS 10 // Green colour for successes
@@ -15,6 +22,9 @@
 
 #define TEMP_FILE "temp.txt" // temporary file for operations that require a temp file
 
+#define SCAN_BLOCK_SIZE (1 << 20) // 1 MB blocks for operations that stream whole files
+#define MAX_REPORTED_OFFSETS 10 // number of invalid UTF-8 offsets listed individually
+
 
 HANDLE hConsole; // Global variable to store console handle to set text attributes
 
@@ -415,77 +425,1202 @@ void printLine(const char *filename) {
     fclose(file);
 }
 
-// Function to list all files and directories in a given directory
-void listDirectory(const char *path) {
-    WIN32_FIND_DATA findFileData; // Structure that holds file information
-    HANDLE hFind;
+// Counts the set bits in a byte mask
+int countBits(unsigned int mask) {
+#if defined(__GNUC__)
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    while (mask) {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+#endif
+}
 
-    char searchPath[256]; // Constructs a search path for the directory
-    snprintf(searchPath, sizeof(searchPath), "%s\\*", path);
+// Returns the position of the lowest set bit in a non-zero mask
+int lowestBit(unsigned int mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int position = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        position++;
+    }
+    return position;
+#endif
+}
+
+// Line ending styles that normalizeFile can convert to
+#define ENDING_LF 1
+#define ENDING_CRLF 2
+#define ENDING_KEEP 3
+
+// State carried from one block to the next while normalizing a file
+typedef struct {
+    int target; // requested line ending style
+    int pendingCR; // a CR was read and is waiting to see if a LF follows
+    int utf8Remaining; // continuation bytes still expected by the current UTF-8 sequence
+    unsigned char utf8Low, utf8High; // allowed range for the next continuation byte
+    long long utf8Start; // offset of the UTF-8 sequence being decoded
+    long long crlfCount, lfCount, crCount; // line endings found in the original file
+    long long invalidCount; // number of invalid UTF-8 sequences
+    long long invalidOffsets[MAX_REPORTED_OFFSETS]; // offsets of the first invalid sequences
+    int bomFound;
+    int changed; // set once the output differs from the input
+} NormalizeState;
+
+// Records the offset of an invalid UTF-8 sequence
+void recordInvalidUtf8(NormalizeState *state, long long offset) {
+    if (state->invalidCount < MAX_REPORTED_OFFSETS) {
+        state->invalidOffsets[state->invalidCount] = offset;
+    }
+    state->invalidCount++;
+}
+
+// Feeds one byte through the UTF-8 validator
+void validateUtf8Byte(NormalizeState *state, unsigned char byte, long long offset) {
+    if (state->utf8Remaining > 0) {
+        if (byte >= state->utf8Low && byte <= state->utf8High) {
+            state->utf8Remaining--;
+            state->utf8Low = 0x80;
+            state->utf8High = 0xBF;
+            return;
+        }
+        recordInvalidUtf8(state, state->utf8Start); // sequence was cut short, re-check this byte as a new one
+        state->utf8Remaining = 0;
+    }
+
+    if (byte < 0x80) return; // plain ASCII
+
+    state->utf8Start = offset;
+    state->utf8Low = 0x80;
+    state->utf8High = 0xBF;
+
+    if (byte >= 0xC2 && byte <= 0xDF) {
+        state->utf8Remaining = 1;
+    } else if (byte >= 0xE0 && byte <= 0xEF) {
+        state->utf8Remaining = 2;
+        if (byte == 0xE0) state->utf8Low = 0xA0; // rejects overlong encodings
+        if (byte == 0xED) state->utf8High = 0x9F; // rejects UTF-16 surrogates
+    } else if (byte >= 0xF0 && byte <= 0xF4) {
+        state->utf8Remaining = 3;
+        if (byte == 0xF0) state->utf8Low = 0x90; // rejects overlong encodings
+        if (byte == 0xF4) state->utf8High = 0x8F; // rejects code points above U+10FFFF
+    } else {
+        recordInvalidUtf8(state, offset); // stray continuation byte or invalid lead byte
+    }
+}
+
+// Converts the line ending of one byte, returns the number of bytes written to out
+size_t convertLineEndingByte(NormalizeState *state, unsigned char byte, unsigned char *out) {
+    size_t written = 0;
+
+    if (state->pendingCR) {
+        state->pendingCR = 0;
+        if (byte == '\n') {
+            state->crlfCount++;
+            if (state->target == ENDING_LF) {
+                state->changed = 1; // drops the CR
+            } else {
+                out[written++] = '\r';
+            }
+            out[written++] = '\n';
+            return written;
+        }
+        state->crCount++; // lone CR is kept as it is
+        out[written++] = '\r';
+    }
+
+    if (byte == '\r') {
+        state->pendingCR = 1; // decided when the next byte arrives
+        return written;
+    }
+
+    if (byte == '\n') {
+        state->lfCount++;
+        if (state->target == ENDING_CRLF) {
+            out[written++] = '\r';
+            state->changed = 1;
+        }
+    }
 
-    hFind = FindFirstFile(searchPath, &findFileData);
-    if (hFind == INVALID_HANDLE_VALUE) {
+    out[written++] = byte;
+    return written;
+}
+
+#ifdef USE_SSE2
+// Finds the bytes in a 16-byte window that the per-byte state machine has to handle: CR, LF and
+// the first byte of anything that is not a complete, valid UTF-8 sequence inside the window
+unsigned int findSpecialBytes(__m128i bytes) {
+    // Signed compares split the high bytes into UTF-8 classes (0x80 is -128, 0xFF is -1)
+    __m128i isContinuation = _mm_cmplt_epi8(bytes, _mm_set1_epi8(-64)); // 0x80 to 0xBF
+    __m128i isLead2 = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-63)), _mm_cmplt_epi8(bytes, _mm_set1_epi8(-32))); // 0xC2 to 0xDF
+    __m128i isLead3 = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-33)), _mm_cmplt_epi8(bytes, _mm_set1_epi8(-16))); // 0xE0 to 0xEF
+    __m128i isLead4 = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-17)), _mm_cmplt_epi8(bytes, _mm_set1_epi8(-11))); // 0xF0 to 0xF4
+
+    unsigned int lineEnds = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')),
+                                                           _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))));
+    unsigned int high = _mm_movemask_epi8(bytes);
+    if (high == 0) return lineEnds; // plain ASCII
+
+    unsigned int continuation = _mm_movemask_epi8(isContinuation);
+    unsigned int lead2 = _mm_movemask_epi8(isLead2);
+    unsigned int lead3 = _mm_movemask_epi8(isLead3);
+    unsigned int lead4 = _mm_movemask_epi8(isLead4);
+
+    // A sequence running past the window is left for the state machine, starting from its lead byte
+    unsigned int window = 0xFFFF;
+    unsigned int overflow = (lead2 & 0x8000) | (lead3 & 0xC000) | (lead4 & 0xE000);
+    if (overflow) window = (1u << lowestBit(overflow)) - 1;
+
+    // Every lead byte must be followed by exactly the right number of continuation bytes
+    lead2 &= window;
+    lead3 &= window;
+    lead4 &= window;
+    unsigned int expected = (lead2 << 1) | (lead3 << 1) | (lead3 << 2) | (lead4 << 1) | (lead4 << 2) | (lead4 << 3);
+    unsigned int invalid = high & ~(continuation | lead2 | lead3 | lead4); // 0xC0, 0xC1 and 0xF5 to 0xFF
+
+    // Second byte limits that reject overlong encodings, surrogates and code points above U+10FFFF
+    unsigned int belowA0 = _mm_movemask_epi8(_mm_cmplt_epi8(bytes, _mm_set1_epi8(-96))); // 0x80 to 0x9F
+    unsigned int below90 = _mm_movemask_epi8(_mm_cmplt_epi8(bytes, _mm_set1_epi8(-112))); // 0x80 to 0x8F
+    unsigned int leadE0 = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xE0)));
+    unsigned int leadED = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xED)));
+    unsigned int leadF0 = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xF0)));
+    unsigned int leadF4 = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xF4)));
+    unsigned int outOfRange = ((leadE0 << 1) & belowA0) | ((leadED << 1) & continuation & ~belowA0) |
+                              ((leadF0 << 1) & below90) | ((leadF4 << 1) & continuation & ~below90);
+
+    if ((expected ^ (continuation & window)) | ((invalid | outOfRange) & window)) {
+        return lineEnds | high; // something is wrong, the state machine finds and reports it
+    }
+
+    return lineEnds | (~window & 0xFFFF);
+}
+#endif
+
+// Normalizes one block, returns the number of bytes written to out (out must hold 2 * length bytes)
+size_t normalizeBlock(NormalizeState *state, const unsigned char *in, size_t length, long long baseOffset, unsigned char *out) {
+    size_t i = 0, written = 0;
+
+    while (i < length) {
+#ifdef USE_SSE2
+        // Copies everything up to the next special byte in bulk, between sequences only
+        if (!state->pendingCR && !state->utf8Remaining && i + 16 <= length) {
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(in + i));
+            unsigned int special = findSpecialBytes(bytes);
+            _mm_storeu_si128((__m128i *)(out + written), bytes); // bytes past the special one are overwritten later
+
+            if (special == 0) {
+                i += 16;
+                written += 16;
+                continue;
+            }
+
+            size_t clean = lowestBit(special);
+            i += clean;
+            written += clean;
+        }
+#endif
+
+        // Only the special byte, and any sequence it starts, goes through the state machine
+        validateUtf8Byte(state, in[i], baseOffset + (long long)i);
+        written += convertLineEndingByte(state, in[i], out + written);
+        i++;
+    }
+
+    return written;
+}
+
+// Function to detect and convert line endings, strip a UTF-8 BOM and validate UTF-8 in a single pass
+void normalizeFile(const char *filename) {
+    FILE *file = fopen(filename, "rb"); // binary mode so CR bytes are seen as they are
+    if (!file) {
         setColour(COLOUR_ERROR);
-        printf("Error: Could not open directory %S\n", path);
+        printf("Error: Could not open file %s.\n", filename);
         setColour(COLOUR_DEFAULT);
         return;
     }
 
+    NormalizeState state = {0}; // target starts at 0, which is rejected below if no number is entered
+
+    printf("Convert line endings to: 1. LF (Linux)  2. CRLF (Windows)  3. Keep as they are\n");
+    printf("Enter your choice: ");
+    scanf("%d", &state.target);
+    while(getchar() != '\n'); // Clears the rest of the line, including anything that was not a number
+
+    if (state.target < ENDING_LF || state.target > ENDING_KEEP) {
+        setColour(COLOUR_ERROR);
+        printf("Invalid Choice.\n");
+        setColour(COLOUR_DEFAULT);
+        fclose(file);
+        return;
+    }
+
+    FILE *tempFile = fopen(TEMP_FILE, "wb");
+    if (!tempFile) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not create temporary file.\n");
+        setColour(COLOUR_DEFAULT);
+        fclose(file);
+        return;
+    }
+
+    unsigned char *inBuffer = malloc(SCAN_BLOCK_SIZE);
+    unsigned char *outBuffer = malloc(2 * SCAN_BLOCK_SIZE + 1); // LF to CRLF can double a block, plus a held CR
+    if (!inBuffer || !outBuffer) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Not enough memory to process %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        free(inBuffer);
+        free(outBuffer);
+        fclose(file);
+        fclose(tempFile);
+        remove(TEMP_FILE);
+        return;
+    }
+
+    long long offset = 0;
+    int writeFailed = 0;
+    size_t bytesRead;
+
+    while (!writeFailed && (bytesRead = fread(inBuffer, 1, SCAN_BLOCK_SIZE, file)) > 0) {
+        size_t start = 0;
+
+        // Strips the byte order mark from the start of the file
+        if (offset == 0 && bytesRead >= 3 && inBuffer[0] == 0xEF && inBuffer[1] == 0xBB && inBuffer[2] == 0xBF) {
+            state.bomFound = 1;
+            state.changed = 1;
+            start = 3;
+        }
+
+        size_t written = normalizeBlock(&state, inBuffer + start, bytesRead - start, offset + (long long)start, outBuffer);
+        if (fwrite(outBuffer, 1, written, tempFile) != written) writeFailed = 1;
+        offset += (long long)bytesRead;
+    }
+
+    // Flushes the state left over at the end of the file
+    if (state.pendingCR) {
+        state.crCount++;
+        if (fputc('\r', tempFile) == EOF) writeFailed = 1;
+    }
+    if (state.utf8Remaining) {
+        recordInvalidUtf8(&state, state.utf8Start);
+    }
+
+    free(inBuffer);
+    free(outBuffer);
+    fclose(file);
+    if (fclose(tempFile) != 0) writeFailed = 1;
+
     setColour(COLOUR_INFO);
-    printf("\nDirectory: %s\n", path);
-    
+    printf("Results for %s:\n", filename);
+    setColour(COLOUR_DEFAULT);
+    printf("Line endings: %lld CRLF, %lld LF, %lld lone CR\n", state.crlfCount, state.lfCount, state.crCount);
+    printf("Byte order mark: %s\n", state.bomFound ? "found" : "none");
+
+    if (state.invalidCount > 0) {
+        setColour(COLOUR_ERROR);
+        printf("Invalid UTF-8 sequences: %lld\n", state.invalidCount);
+        setColour(COLOUR_DEFAULT);
+        for (long long i = 0; i < state.invalidCount && i < MAX_REPORTED_OFFSETS; i++) {
+            printf("  at byte offset %lld\n", state.invalidOffsets[i]);
+        }
+        if (state.invalidCount > MAX_REPORTED_OFFSETS) {
+            printf("  ... and %lld more\n", state.invalidCount - MAX_REPORTED_OFFSETS);
+        }
+    } else {
+        printf("UTF-8: valid\n");
+    }
+
+    if (writeFailed) {
+        remove(TEMP_FILE);
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not write temporary file, %s was left unchanged.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    if (!state.changed) {
+        remove(TEMP_FILE); // nothing to convert, the original file is left untouched
+        setColour(COLOUR_SUCCESS);
+        printf("No changes needed for %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    // Replaces the original file in one step, copying if the temp file is on another drive
+    if (!MoveFileEx(TEMP_FILE, filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED)) {
+        char tempPath[MAX_PATH];
+        if (!GetFullPathName(TEMP_FILE, sizeof(tempPath), tempPath, NULL)) strcpy(tempPath, TEMP_FILE);
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not replace %s (error %lu). %s was left unchanged, the converted data is in %s.\n",
+               filename, (unsigned long)GetLastError(), filename, tempPath);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    setColour(COLOUR_SUCCESS);
+    printf("File %s normalized successfully.\n", filename);
+    setColour(COLOUR_DEFAULT);
+
+    logChange(filename, "Normalized");
+}
+
+#define FOLLOW_BLOCK_SIZE 4096 // bytes read at a time while following a file
+#define FOLLOW_POLL_MS 1000 // fallback re-check in case a change notification is delayed
+
+// Opens a file for reading without stopping other programs from writing, renaming or deleting it
+HANDLE openSharedForRead(const char *filename) {
+    return CreateFile(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                      NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+}
+
+// Prints the bytes of a file between two offsets
+void printFileRange(HANDLE file, long long from, long long to) {
+    char buffer[FOLLOW_BLOCK_SIZE];
+    LARGE_INTEGER position;
+    position.QuadPart = from;
+    if (!SetFilePointerEx(file, position, NULL, FILE_BEGIN)) return;
+
+    while (from < to) {
+        DWORD wanted = (to - from) < FOLLOW_BLOCK_SIZE ? (DWORD)(to - from) : FOLLOW_BLOCK_SIZE;
+        DWORD bytesRead = 0;
+        if (!ReadFile(file, buffer, wanted, &bytesRead, NULL) || bytesRead == 0) break;
+        fwrite(buffer, 1, bytesRead, stdout);
+        from += bytesRead;
+    }
+    fflush(stdout);
+}
+
+// Finds where the last lineCount lines start by scanning backward from the end of the file
+long long findLastLinesStart(HANDLE file, long long fileSize, int lineCount) {
+    char buffer[FOLLOW_BLOCK_SIZE];
+    long long position = fileSize;
+    int newlines = 0;
+
+    if (lineCount <= 0) return fileSize;
+
+    while (position > 0) {
+        DWORD chunk = position < FOLLOW_BLOCK_SIZE ? (DWORD)position : FOLLOW_BLOCK_SIZE;
+        DWORD bytesRead = 0;
+        LARGE_INTEGER seekTo;
+        position -= chunk;
+        seekTo.QuadPart = position;
+
+        if (!SetFilePointerEx(file, seekTo, NULL, FILE_BEGIN) || !ReadFile(file, buffer, chunk, &bytesRead, NULL) || bytesRead != chunk) {
+            return 0; // falls back to showing the whole file
+        }
+
+        for (long long i = chunk - 1; i >= 0; i--) {
+            // The newline ending the last line does not start a new line
+            if (buffer[i] == '\n' && position + i != fileSize - 1) {
+                newlines++;
+                if (newlines == lineCount) return position + i + 1;
+            }
+        }
+    }
+
+    return 0; // file has fewer lines than requested
+}
+
+// Checks if two handles refer to the same file on disk
+int isSameFile(const BY_HANDLE_FILE_INFORMATION *a, const BY_HANDLE_FILE_INFORMATION *b) {
+    return a->dwVolumeSerialNumber == b->dwVolumeSerialNumber &&
+           a->nFileIndexHigh == b->nFileIndexHigh &&
+           a->nFileIndexLow == b->nFileIndexLow;
+}
+
+// Prints anything appended since the last check, handling truncation and rotation
+void printAppendedData(const char *filename, BY_HANDLE_FILE_INFORMATION *identity, long long *offset, int *missing) {
+    HANDLE file = openSharedForRead(filename);
+    if (file == INVALID_HANDLE_VALUE) {
+        if (!*missing) {
+            setColour(COLOUR_INFO);
+            printf("\n--- %s is not available, waiting for it to reappear ---\n", filename);
+            setColour(COLOUR_DEFAULT);
+            *missing = 1;
+        }
+        return;
+    }
+    *missing = 0;
+
+    BY_HANDLE_FILE_INFORMATION current;
+    LARGE_INTEGER size;
+    if (!GetFileInformationByHandle(file, &current) || !GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return;
+    }
+
+    if (!isSameFile(identity, &current)) {
+        setColour(COLOUR_INFO);
+        printf("\n--- %s was replaced, following the new file ---\n", filename);
+        setColour(COLOUR_DEFAULT);
+        *identity = current;
+        *offset = 0;
+    } else if (size.QuadPart < *offset) {
+        setColour(COLOUR_INFO);
+        printf("\n--- %s was truncated ---\n", filename);
+        setColour(COLOUR_DEFAULT);
+        *offset = 0;
+    }
+
+    if (size.QuadPart > *offset) {
+        printFileRange(file, *offset, size.QuadPart);
+        *offset = size.QuadPart;
+    }
+
+    CloseHandle(file);
+}
+
+// Function to print the last lines of a file and then keep printing new data as it is appended
+void followFile(const char *filename) {
+    HANDLE file = openSharedForRead(filename);
+    if (file == INVALID_HANDLE_VALUE) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not open file %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    int lineCount = -1;
+    printf("Enter the number of lines to show: ");
+    scanf("%d", &lineCount);
+    while(getchar() != '\n'); // Clears the rest of the line, including anything that was not a number
+
+    if (lineCount < 0) {
+        setColour(COLOUR_ERROR);
+        printf("Invalid line number.\n");
+        setColour(COLOUR_DEFAULT);
+        CloseHandle(file);
+        return;
+    }
+
+    BY_HANDLE_FILE_INFORMATION identity;
+    LARGE_INTEGER size;
+    if (!GetFileInformationByHandle(file, &identity) || !GetFileSizeEx(file, &size)) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not read file %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        CloseHandle(file);
+        return;
+    }
+
+    setColour(COLOUR_INFO);
+    printf("Last %d lines of %s:\n", lineCount, filename);
+    setColour(COLOUR_DEFAULT);
+
+    long long offset = size.QuadPart;
+    printFileRange(file, findLastLinesStart(file, offset, lineCount), offset);
+    CloseHandle(file); // not kept open so the file can still be rotated or deleted
+
+    // A key press is the only way to stop, and a redirected stdin is always signalled, so following needs a console
+    HANDLE input = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD consoleMode;
+    if (!GetConsoleMode(input, &consoleMode)) {
+        setColour(COLOUR_ERROR);
+        printf("\nError: Cannot follow %s because input is not a console.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    // Watches the directory holding the file, since that also reports renames and deletes
+    char directory[MAX_PATH];
+    char *fileNamePart = NULL;
+    if (!GetFullPathName(filename, sizeof(directory), directory, &fileNamePart) || !fileNamePart) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not resolve the directory of %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+    *fileNamePart = '\0';
+
+    HANDLE change = FindFirstChangeNotification(directory, FALSE,
+        FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+    if (change == INVALID_HANDLE_VALUE) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not watch directory %s.\n", directory);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    FlushConsoleInputBuffer(input);
+
+    setColour(COLOUR_INFO);
+    printf("\nFollowing %s. Press any key to stop.\n", filename);
+    setColour(COLOUR_DEFAULT);
+
+    HANDLE waitHandles[2] = { change, input };
+    int missing = 0;
+
+    while (1) {
+        // Sleeps until the directory changes or a key is pressed
+        DWORD result = WaitForMultipleObjects(2, waitHandles, FALSE, FOLLOW_POLL_MS);
+
+        if (result == WAIT_OBJECT_0 + 1) {
+            INPUT_RECORD record;
+            DWORD eventsRead = 0;
+            if (ReadConsoleInput(input, &record, 1, &eventsRead) && eventsRead == 1 &&
+                record.EventType == KEY_EVENT && record.Event.KeyEvent.bKeyDown) {
+                break;
+            }
+            continue; // ignores key releases, mouse and resize events
+        }
+
+        if (result == WAIT_FAILED) {
+            setColour(COLOUR_ERROR);
+            printf("Error: Stopped following %s.\n", filename);
+            setColour(COLOUR_DEFAULT);
+            break;
+        }
+
+        if (result == WAIT_OBJECT_0) {
+            FindNextChangeNotification(change); // re-arms the notification before reading
+        }
+
+        printAppendedData(filename, &identity, &offset, &missing);
+    }
+
+    FindCloseChangeNotification(change);
+    FlushConsoleInputBuffer(input); // drops the key release so it does not reach the menu
+
+    setColour(COLOUR_SUCCESS);
+    printf("\nStopped following %s.\n", filename);
+    setColour(COLOUR_DEFAULT);
+}
+
+#define STATS_MIN_CHUNK (16 << 20) // files are only split into chunks of at least 16 MB
+
+// Partial statistics for one chunk of a file, merged in order once every chunk is done
+typedef struct {
+    const char *filename;
+    long long start, length; // byte range handled by this chunk
+    int failed;
+    unsigned long long chars, words, newlines;
+    unsigned long long blankLines, longestLine; // lines that start and end inside the chunk
+    unsigned long long prefixLength; // text before the first newline, which continues the previous chunk's line
+    int prefixBlank, prefixEndsWithCR;
+    int firstIsSpace; // needed to join a word split across two chunks
+    // Scan state, which at the end describes the text after the last newline
+    unsigned long long lineLength;
+    int lineBlank, previousSpace, previousCR;
+} ChunkStats;
+
+// Ends the current line at a newline
+void closeStatsLine(ChunkStats *stats, int endsWithCR) {
+    if (stats->newlines == 0) {
+        stats->prefixLength = stats->lineLength; // the start of this line is in an earlier chunk
+        stats->prefixBlank = stats->lineBlank;
+        stats->prefixEndsWithCR = endsWithCR;
+    } else {
+        unsigned long long length = stats->lineLength - endsWithCR; // a CRLF line ending is not counted
+        if (length > stats->longestLine) stats->longestLine = length;
+        if (stats->lineBlank) stats->blankLines++;
+    }
+
+    stats->newlines++;
+    stats->lineLength = 0;
+    stats->lineBlank = 1;
+}
+
+// Adds one block of bytes to the chunk statistics
+void scanStatsBlock(ChunkStats *stats, const unsigned char *buffer, size_t length) {
+    size_t i = 0;
+
+#ifdef USE_SSE2
+    // Classifies 16 bytes at once into newline, CR, whitespace and UTF-8 continuation masks
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(buffer + i));
+        __m128i controlOffset = _mm_sub_epi8(bytes, _mm_set1_epi8('\t'));
+        __m128i isControlSpace = _mm_cmpeq_epi8(_mm_min_epu8(controlOffset, _mm_set1_epi8(4)), controlOffset); // \t \n \v \f \r
+        unsigned int space = _mm_movemask_epi8(_mm_or_si128(isControlSpace, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '))));
+        unsigned int newline = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+        unsigned int carriageReturn = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+        unsigned int continuation = _mm_movemask_epi8(_mm_cmplt_epi8(bytes, _mm_set1_epi8((char)0xC0))); // 0x80 to 0xBF
+        unsigned int nonSpace = ~space & 0xFFFF;
+
+        stats->chars += 16 - countBits(continuation);
+        stats->words += countBits(nonSpace & ((space << 1) | (unsigned int)stats->previousSpace)); // word starts
+        stats->previousSpace = (space >> 15) & 1;
+
+        unsigned int start = 0;
+        while (newline) {
+            unsigned int position = lowestBit(newline);
+            unsigned int segment = ((1u << position) - 1) & ~((1u << start) - 1);
+            if (nonSpace & segment) stats->lineBlank = 0;
+            stats->lineLength += position - start;
+            closeStatsLine(stats, position > 0 ? (int)((carriageReturn >> (position - 1)) & 1) : stats->previousCR);
+            start = position + 1;
+            newline &= newline - 1;
+        }
+
+        if (nonSpace & 0xFFFF & ~((1u << start) - 1)) stats->lineBlank = 0;
+        stats->lineLength += 16 - start;
+        stats->previousCR = (carriageReturn >> 15) & 1;
+    }
+#endif
+
+    for (; i < length; i++) {
+        unsigned char byte = buffer[i];
+        int isSpace = byte == ' ' || (byte >= '\t' && byte <= '\r');
+
+        if ((byte & 0xC0) != 0x80) stats->chars++; // counts every byte that starts a character
+        if (!isSpace && stats->previousSpace) stats->words++;
+        stats->previousSpace = isSpace;
+
+        if (byte == '\n') {
+            closeStatsLine(stats, stats->previousCR);
+        } else {
+            stats->lineLength++;
+            if (!isSpace) stats->lineBlank = 0;
+        }
+        stats->previousCR = byte == '\r';
+    }
+}
+
+// Thread function that reads and scans one chunk of a file
+DWORD WINAPI statsWorker(LPVOID parameter) {
+    ChunkStats *stats = parameter;
+    stats->lineBlank = 1;
+    stats->previousSpace = 1;
+
+    HANDLE file = openSharedForRead(stats->filename); // each thread has its own handle and file position
+    unsigned char *buffer = malloc(SCAN_BLOCK_SIZE);
+    LARGE_INTEGER position;
+    position.QuadPart = stats->start;
+
+    if (file == INVALID_HANDLE_VALUE || !buffer || !SetFilePointerEx(file, position, NULL, FILE_BEGIN)) {
+        stats->failed = 1;
+    }
+
+    long long remaining = stats->length;
+    while (!stats->failed && remaining > 0) {
+        DWORD wanted = remaining < SCAN_BLOCK_SIZE ? (DWORD)remaining : SCAN_BLOCK_SIZE;
+        DWORD bytesRead = 0;
+        if (!ReadFile(file, buffer, wanted, &bytesRead, NULL) || bytesRead == 0) {
+            stats->failed = 1; // file shrank or could not be read
+            break;
+        }
+
+        if (remaining == stats->length) {
+            stats->firstIsSpace = buffer[0] == ' ' || (buffer[0] >= '\t' && buffer[0] <= '\r');
+        }
+
+        scanStatsBlock(stats, buffer, bytesRead);
+        remaining -= bytesRead;
+    }
+
+    free(buffer);
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    return 0;
+}
+
+// Function to show line, word, byte and character statistics, scanning chunks of the file in parallel
+void printFileStatistics(const char *filename) {
+    HANDLE file = openSharedForRead(filename);
+    LARGE_INTEGER size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size)) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not open file %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        return;
+    }
+    CloseHandle(file);
+
+    // One chunk per processor, unless the file is too small for that to pay off
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    long long chunkCount = systemInfo.dwNumberOfProcessors;
+    if (chunkCount > MAXIMUM_WAIT_OBJECTS) chunkCount = MAXIMUM_WAIT_OBJECTS;
+    if (chunkCount > size.QuadPart / STATS_MIN_CHUNK) chunkCount = size.QuadPart / STATS_MIN_CHUNK;
+    if (chunkCount < 1) chunkCount = 1;
+
+    ChunkStats *chunks = calloc((size_t)chunkCount, sizeof(ChunkStats));
+    if (!chunks) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Not enough memory to process %s.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    HANDLE threads[MAXIMUM_WAIT_OBJECTS] = {0};
+    ULONGLONG startTime = GetTickCount64();
+
+    for (long long i = 0; i < chunkCount; i++) {
+        chunks[i].filename = filename;
+        chunks[i].start = size.QuadPart * i / chunkCount;
+        chunks[i].length = size.QuadPart * (i + 1) / chunkCount - chunks[i].start;
+        if (i > 0) threads[i] = CreateThread(NULL, 0, statsWorker, &chunks[i], 0, NULL);
+    }
+
+    // The first chunk runs on this thread, as does any chunk whose thread could not be started
+    for (long long i = 0; i < chunkCount; i++) {
+        if (!threads[i]) statsWorker(&chunks[i]);
+    }
+
+    for (long long i = 1; i < chunkCount; i++) {
+        if (threads[i]) {
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        }
+    }
+
+    // Merges the chunks in file order, joining the lines and words that cross chunk boundaries
+    unsigned long long chars = 0, words = 0, lines = 0, blankLines = 0, longestLine = 0;
+    unsigned long long openLength = 0; // line still running at the end of the previous chunk
+    int openBlank = 1, openEndsWithCR = 0, previousEndsInWord = 0, failed = 0;
+
+    for (long long i = 0; i < chunkCount; i++) {
+        const ChunkStats *chunk = &chunks[i];
+        if (chunk->failed) failed = 1;
+        if (chunk->length == 0) continue;
+
+        chars += chunk->chars;
+        words += chunk->words;
+        if (previousEndsInWord && !chunk->firstIsSpace) words--; // the same word was counted by both chunks
+
+        if (chunk->newlines > 0) {
+            unsigned long long length = openLength + chunk->prefixLength;
+            length -= chunk->prefixLength > 0 ? chunk->prefixEndsWithCR : openEndsWithCR;
+            if (length > longestLine) longestLine = length;
+            if (openBlank && chunk->prefixBlank) blankLines++;
+
+            if (chunk->longestLine > longestLine) longestLine = chunk->longestLine;
+            blankLines += chunk->blankLines;
+            lines += chunk->newlines;
+
+            openLength = chunk->lineLength;
+            openBlank = chunk->lineBlank;
+        } else {
+            openLength += chunk->lineLength;
+            openBlank = openBlank && chunk->lineBlank;
+        }
+
+        openEndsWithCR = chunk->previousCR;
+        previousEndsInWord = !chunk->previousSpace;
+    }
+
+    // A last line without a newline still counts as a line
+    if (openLength > 0) {
+        lines++;
+        if (openLength - openEndsWithCR > longestLine) longestLine = openLength - openEndsWithCR;
+        if (openBlank) blankLines++;
+    }
+
+    ULONGLONG elapsed = GetTickCount64() - startTime;
+    free(chunks);
+
+    if (failed) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not read all of %s, it may have changed during the scan.\n", filename);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    setColour(COLOUR_INFO);
+    printf("Statistics for %s:\n", filename);
+    setColour(COLOUR_DEFAULT);
+    printf("Lines: %llu\n", lines);
+    printf("Blank lines: %llu\n", blankLines);
+    printf("Words: %llu\n", words);
+    printf("Characters (UTF-8): %llu\n", chars);
+    printf("Bytes: %lld\n", (long long)size.QuadPart);
+    printf("Longest line: %llu bytes\n", longestLine);
+    printf("Scanned in %llu ms using %lld thread(s).\n", (unsigned long long)elapsed, chunkCount);
+}
+
+#define EXPLORER_LIST_LIMIT 200 // directories larger than this are not listed automatically
+#define MAX_SHOWN_COMPLETIONS 50 // completion candidates printed before the list is cut short
+#define JUMP_PAGE_SIZE 20 // entries listed from the position 'jump' finds
+
+// One entry of an in-memory directory index
+typedef struct {
+    char *name; // points into the index name pool
+    int isDirectory;
+    unsigned long long size;
+} DirectoryEntry;
+
+// Sorted index of a directory's entries, so lookups do not have to re-enumerate the directory
+typedef struct {
+    char path[MAX_PATH]; // directory the index was built from
+    FILETIME lastWrite; // directory write time when the index was built
+    DirectoryEntry *entries; // sorted case-insensitively by name
+    size_t count, capacity;
+    char *namePool; // all entry names, stored back to back
+    size_t poolUsed, poolCapacity;
+} DirectoryIndex;
+
+DirectoryIndex workingIndex; // Global index of the current working directory, shared by the explorer and file prompts
+
+// Compares two entries by name, ignoring case like the Windows file system does
+int compareEntries(const void *a, const void *b) {
+    return _stricmp(((const DirectoryEntry *)a)->name, ((const DirectoryEntry *)b)->name);
+}
+
+// Function to empty a directory index and free its memory
+void freeDirectoryIndex(DirectoryIndex *index) {
+    free(index->entries);
+    free(index->namePool);
+    memset(index, 0, sizeof(*index));
+}
+
+// Function to enumerate a directory once and build a sorted index of it
+int buildDirectoryIndex(DirectoryIndex *index, const char *path) {
+    WIN32_FIND_DATA findFileData;
+    WIN32_FILE_ATTRIBUTE_DATA directoryData;
+    char searchPath[MAX_PATH + 2];
+
+    freeDirectoryIndex(index);
+
+    if (!GetFileAttributesEx(path, GetFileExInfoStandard, &directoryData)) return 0;
+
+    snprintf(searchPath, sizeof(searchPath), "%s\\*", path);
+    HANDLE hFind = FindFirstFile(searchPath, &findFileData);
+    if (hFind == INVALID_HANDLE_VALUE) return 0;
+
+    size_t *nameOffsets = NULL; // offsets are kept until the pool stops moving
+
+    do {
+        if (strcmp(findFileData.cFileName, ".") == 0 || strcmp(findFileData.cFileName, "..") == 0) continue;
+
+        size_t nameLength = strlen(findFileData.cFileName) + 1;
+
+        if (index->count == index->capacity) {
+            size_t newCapacity = index->capacity ? index->capacity * 2 : 256;
+            DirectoryEntry *newEntries = realloc(index->entries, newCapacity * sizeof(DirectoryEntry));
+            size_t *newOffsets = realloc(nameOffsets, newCapacity * sizeof(size_t));
+            if (newEntries) index->entries = newEntries;
+            if (newOffsets) nameOffsets = newOffsets;
+            if (!newEntries || !newOffsets) break;
+            index->capacity = newCapacity;
+        }
+
+        if (index->poolUsed + nameLength > index->poolCapacity) {
+            size_t newCapacity = index->poolCapacity ? index->poolCapacity * 2 : 16384;
+            while (newCapacity < index->poolUsed + nameLength) newCapacity *= 2;
+            char *newPool = realloc(index->namePool, newCapacity);
+            if (!newPool) break;
+            index->namePool = newPool;
+            index->poolCapacity = newCapacity;
+        }
+
+        memcpy(index->namePool + index->poolUsed, findFileData.cFileName, nameLength);
+        nameOffsets[index->count] = index->poolUsed;
+        index->poolUsed += nameLength;
+
+        DirectoryEntry *entry = &index->entries[index->count++];
+        entry->isDirectory = (findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        entry->size = ((unsigned long long)findFileData.nFileSizeHigh << 32) | findFileData.nFileSizeLow;
+    } while (FindNextFile(hFind, &findFileData) != 0);
+
+    FindClose(hFind);
+
+    for (size_t i = 0; i < index->count; i++) {
+        index->entries[i].name = index->namePool + nameOffsets[i];
+    }
+    free(nameOffsets);
+
+    qsort(index->entries, index->count, sizeof(DirectoryEntry), compareEntries);
+
+    strncpy(index->path, path, sizeof(index->path) - 1);
+    index->path[sizeof(index->path) - 1] = '\0';
+    index->lastWrite = directoryData.ftLastWriteTime;
+    return 1;
+}
+
+// Function to reuse an index unless the directory changed since it was built
+int refreshDirectoryIndex(DirectoryIndex *index, const char *path) {
+    WIN32_FILE_ATTRIBUTE_DATA directoryData;
+
+    // Creating, deleting or renaming an entry updates the directory's write time
+    if (index->path[0] != '\0' && _stricmp(index->path, path) == 0 &&
+        GetFileAttributesEx(path, GetFileExInfoStandard, &directoryData) &&
+        CompareFileTime(&directoryData.ftLastWriteTime, &index->lastWrite) == 0) {
+        return 1;
+    }
+
+    return buildDirectoryIndex(index, path);
+}
+
+// Finds the position of the first entry that is not less than the prefix (binary search)
+size_t findFirstWithPrefix(const DirectoryIndex *index, const char *prefix) {
+    size_t low = 0, high = index->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (_stricmp(index->entries[middle].name, prefix) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Counts the entries starting with a prefix, they are all next to each other in the sorted index
+size_t countWithPrefix(const DirectoryIndex *index, const char *prefix, size_t *first) {
+    size_t prefixLength = strlen(prefix);
+    size_t start = findFirstWithPrefix(index, prefix), end = start;
+
+    while (end < index->count && _strnicmp(index->entries[end].name, prefix, prefixLength) == 0) {
+        end++;
+    }
+
+    *first = start;
+    return end - start;
+}
+
+// Looks up an entry by its exact name, ignoring case
+DirectoryEntry *findEntry(const DirectoryIndex *index, const char *name) {
+    size_t position = findFirstWithPrefix(index, name);
+    if (position < index->count && _stricmp(index->entries[position].name, name) == 0) {
+        return &index->entries[position];
+    }
+    return NULL;
+}
+
+// Checks a name against a pattern where * matches any run of characters and ? matches one
+int matchesPattern(const char *name, const char *pattern) {
+    const char *starPattern = NULL, *starName = NULL;
+
+    while (*name) {
+        if (*pattern == '*') {
+            starPattern = ++pattern; // remembers where to retry from if a later match fails
+            starName = name;
+        } else if (*pattern == '?' || tolower((unsigned char)*pattern) == tolower((unsigned char)*name)) {
+            pattern++;
+            name++;
+        } else if (starPattern) {
+            pattern = starPattern;
+            name = ++starName;
+        } else {
+            return 0;
+        }
+    }
+
+    while (*pattern == '*') pattern++;
+    return *pattern == '\0';
+}
+
+// Function to print the entries of an index from position first up to end, stopping after limit entries are shown
+// Returns the position after the last entry looked at
+size_t printEntries(const DirectoryIndex *index, size_t first, size_t end, const char *pattern, size_t limit, size_t *shown) {
+    size_t i;
+    *shown = 0;
+
+    setColour(COLOUR_INFO);
+    printf("\nDirectory: %s\n", index->path);
+
     // Header for directory listing
     printf("------------------------------------------------------------------------------------------------------------------------------\n");
     printf("%-60s%-20s%-20s\n", "File Name", "Type", "Size (bytes)");
     printf("------------------------------------------------------------------------------------------------------------------------------\n");
 
-    // Iterates through all files and subdirectories in the directory
-    do {
-        if (strcmp(findFileData.cFileName, ".") == 0 || strcmp(findFileData.cFileName, "..") == 0) continue;
+    // Iterates through the files and subdirectories in the range
+    for (i = first; i < end && *shown < limit; i++) {
+        const DirectoryEntry *entry = &index->entries[i];
+        if (pattern && !matchesPattern(entry->name, pattern)) continue;
+        (*shown)++;
 
-        if (findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+        if (entry->isDirectory) {
             setColour(COLOUR_FOLDER);
-            printf("[Folder] %-60s%-20s%-20s\n", findFileData.cFileName, "Directory", "N/A");
+            printf("[Folder] %-60s%-20s%-20s\n", entry->name, "Directory", "N/A");
         } else {
             setColour(COLOUR_DEFAULT);
-            if (strstr(findFileData.cFileName, ".txt") != NULL) {
+            if (strstr(entry->name, ".txt") != NULL) {
                 setColour(COLOUR_TEXT);
             }
-            printf("         %-60s%-20s%-20ld\n", findFileData.cFileName, "File", findFileData.nFileSizeLow);
+            printf("         %-60s%-20s%-20llu\n", entry->name, "File", entry->size);
             setColour(COLOUR_DEFAULT);
         }
-    } while (FindNextFile(hFind, &findFileData) != 0);
-
-    FindClose(hFind); // Close the directory handle
+    }
 
     setColour(COLOUR_INFO);
     printf("------------------------------------------------------------------------------------------------------------------------------\n");
     setColour(COLOUR_DEFAULT);
+    return i;
+}
+
+// Function to list the entries of an index, optionally only those matching a pattern
+void listDirectory(const DirectoryIndex *index, const char *pattern) {
+    char prefix[MAX_PATH] = "";
+    int hasWildcard = 0;
+
+    if (pattern && pattern[0] != '\0') {
+        // Uses the text before the first wildcard to narrow the search to one range of the index
+        size_t prefixLength = strcspn(pattern, "*?");
+        hasWildcard = pattern[prefixLength] != '\0';
+        if (prefixLength >= sizeof(prefix)) prefixLength = sizeof(prefix) - 1;
+        memcpy(prefix, pattern, prefixLength);
+        prefix[prefixLength] = '\0';
+    }
+
+    size_t first, shown;
+    size_t candidates = countWithPrefix(index, prefix, &first);
+    printEntries(index, first, first + candidates, hasWildcard ? pattern : NULL, (size_t)-1, &shown);
+
+    setColour(COLOUR_INFO);
+    printf("%lu of %lu entries shown.\n", (unsigned long)shown, (unsigned long)index->count);
+    setColour(COLOUR_DEFAULT);
+
+}
+
+// Function to complete a partly typed name, returns 1 if exactly one entry matched
+// Otherwise the matches are listed on the lines below the one being typed
+int completeName(const DirectoryIndex *index, char *name, size_t size) {
+    size_t first;
+    size_t matches = countWithPrefix(index, name, &first);
+
+    if (matches == 0) {
+        setColour(COLOUR_ERROR);
+        printf("\nNo entries start with \"%s\".\n", name);
+        setColour(COLOUR_DEFAULT);
+        return 0;
+    }
+
+    if (matches == 1) {
+        strncpy(name, index->entries[first].name, size - 1);
+        name[size - 1] = '\0';
+        return 1;
+    }
+
+    // Extends the typed text to the longest prefix shared by every match
+    const char *firstName = index->entries[first].name;
+    const char *lastName = index->entries[first + matches - 1].name;
+    size_t common = 0;
+    while (firstName[common] && tolower((unsigned char)firstName[common]) == tolower((unsigned char)lastName[common])) {
+        common++;
+    }
+    if (common >= size) common = size - 1;
+    memcpy(name, firstName, common);
+    name[common] = '\0';
+
+    setColour(COLOUR_INFO);
+    printf("\n%lu entries start with \"%s\":\n", (unsigned long)matches, name);
+    setColour(COLOUR_DEFAULT);
+    for (size_t i = first; i < first + matches && i < first + MAX_SHOWN_COMPLETIONS; i++) {
+        printf("  %s%s\n", index->entries[i].name, index->entries[i].isDirectory ? "\\" : "");
+    }
+    if (matches > MAX_SHOWN_COMPLETIONS) {
+        printf("  ... and %lu more\n", (unsigned long)(matches - MAX_SHOWN_COMPLETIONS));
+    }
+    return 0;
+}
+
+// Function to read a line from the console, completing names from the current directory when Tab is pressed
+// If the line starts with one of the NULL-terminated commands, only the text after the command is completed
+void readLineWithCompletion(const char *prompt, const char *const *commands, char *buffer, size_t size) {
+    HANDLE input = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD mode;
+    size_t length = 0;
+
+    printf("%s", prompt);
+    buffer[0] = '\0';
+
+    // Falls back to plain line input when stdin is not a console, e.g. redirected from a file
+    if (!GetConsoleMode(input, &mode)) {
+        if (fgets(buffer, (int)size, stdin) == NULL) buffer[0] = '\0';
+        buffer[strcspn(buffer, "\n")] = 0;
+        return;
+    }
+
+    // Reads key presses one at a time, so Tab is seen as soon as it is pressed
+    while (1) {
+        INPUT_RECORD record;
+        DWORD eventsRead = 0;
+        if (!ReadConsoleInput(input, &record, 1, &eventsRead)) break;
+        if (eventsRead != 1 || record.EventType != KEY_EVENT || !record.Event.KeyEvent.bKeyDown) continue;
+
+        WORD key = record.Event.KeyEvent.wVirtualKeyCode;
+        char ch = record.Event.KeyEvent.uChar.AsciiChar;
+
+        if (key == VK_RETURN) {
+            printf("\n");
+            break;
+        }
+
+        if (key == VK_BACK) {
+            if (length > 0) {
+                buffer[--length] = '\0';
+                printf("\b \b"); // erases the last character on screen
+            }
+        } else if (key == VK_TAB) {
+            char currentPath[MAX_PATH];
+            size_t nameStart = 0;
+            for (int i = 0; commands && commands[i]; i++) {
+                size_t commandLength = strlen(commands[i]);
+                if (strncmp(buffer, commands[i], commandLength) == 0) nameStart = commandLength;
+            }
+
+            if (_getcwd(currentPath, sizeof(currentPath)) != NULL && refreshDirectoryIndex(&workingIndex, currentPath)) {
+                // Completes the name in place, so the command in front of it is kept
+                if (completeName(&workingIndex, buffer + nameStart, size - nameStart)) {
+                    printf("%s", buffer + length); // only the completed part is new on screen
+                } else {
+                    printf("%s%s", prompt, buffer); // redraws the line, extended to the shared prefix, below the matches
+                }
+                length = strlen(buffer);
+            }
+        } else if ((unsigned char)ch >= ' ' && length + 1 < size) {
+            buffer[length++] = ch;
+            buffer[length] = '\0';
+            putchar(ch);
+        }
+        fflush(stdout);
+    }
+}
 
+// Function to read a file name, with Tab completion from the current directory
+void readFileName(const char *prompt, char *filename, size_t size) {
+    readLineWithCompletion(prompt, NULL, filename, size);
+    appendTxtExtension(filename);
+}
+
+// Function to enter a directory and show it, or a summary if it is too large to list
+void enterDirectory(char *currentPath, size_t size) {
+    if (_getcwd(currentPath, (int)size) == NULL) {
+        perror("getcwd() error");
+        return;
+    }
+    printf("Current Directory: %s\n", currentPath); // update
+
+    if (!refreshDirectoryIndex(&workingIndex, currentPath)) {
+        setColour(COLOUR_ERROR);
+        printf("Error: Could not open directory %s\n", currentPath);
+        setColour(COLOUR_DEFAULT);
+        return;
+    }
+
+    if (workingIndex.count <= EXPLORER_LIST_LIMIT) {
+        listDirectory(&workingIndex, NULL);
+    } else {
+        setColour(COLOUR_INFO);
+        printf("%lu entries. Use 'ls <pattern>' to filter or 'ls' to list them all.\n", (unsigned long)workingIndex.count);
+        setColour(COLOUR_DEFAULT);
+    }
 }
 
 // Function to provide a navigatable file explorer
 void fileExplorer() {
     char currentPath[MAX_PATH]; // stores the current directory
     char input[256]; // input buffer
+    const char *explorerCommands[] = { "ls ", "jump ", NULL }; // commands followed by a name that Tab can complete
 
-    // Print current working directory
-    if (_getcwd(currentPath, sizeof(currentPath)) != NULL) {
-        printf("Current Directory: %s\n", currentPath);
-    }
-    else {
+    // Print current working directory and its contents
+    if (_getcwd(currentPath, sizeof(currentPath)) == NULL) {
         perror("getcwd() error");
         return;
     }
+    enterDirectory(currentPath, sizeof(currentPath));
 
     while(1) {
-        listDirectory(currentPath); // Displays the contents of the current directory
+        printf("\nEnter a directory name to enter (Tab completes it), '..' to go up,\n");
 
-        printf("\nEnter a directory name to enter, '..' to go up or 'exit' to return: ");
-        
-        fgets(input, sizeof(input), stdin); // gets the users command
-
-        input[strcspn(input, "\n")] = 0;
+        // gets the users command
+        readLineWithCompletion("'ls [pattern]' to list, 'jump <prefix>' to find, 'refresh' to re-read or 'exit' to return: ",
+                               explorerCommands, input, sizeof(input));
 
         if (strcmp(input, "exit") == 0) {
             break; // exit the file explorer
@@ -493,25 +1628,61 @@ void fileExplorer() {
 
         if (strcmp(input, "..") == 0) {
             if (SetCurrentDirectory("..")) { // Navigates to the parent directory
-                if (_getcwd(currentPath, sizeof(currentPath)) != NULL) {
-                    printf("Current Directory: %s\n", currentPath); // Update and display
-                } else {
-                    perror("getcwd() error");
-                    break;
-                }
+                enterDirectory(currentPath, sizeof(currentPath));
             } else {
                 printf("Error: Could not go up to the parent directory.\n");
             }
             continue;
         }
 
-        if (SetCurrentDirectory(input)) { // Attempt to change to given subdirectory
-            if (_getcwd(currentPath, sizeof(currentPath)) != NULL) {
-                printf("Current Directory: %s\n", currentPath); // update
-            } else {
-                perror("getcwd() error");
-                break;
+        if (strcmp(input, "ls") == 0 || strncmp(input, "ls ", 3) == 0) {
+            refreshDirectoryIndex(&workingIndex, currentPath);
+            listDirectory(&workingIndex, input[2] == ' ' ? input + 3 : NULL);
+            continue;
+        }
+
+        if (strcmp(input, "refresh") == 0) {
+            buildDirectoryIndex(&workingIndex, currentPath); // forced, picks up size changes too
+            printf("%lu entries indexed.\n", (unsigned long)workingIndex.count);
+            continue;
+        }
+
+        if (strncmp(input, "jump ", 5) == 0) {
+            refreshDirectoryIndex(&workingIndex, currentPath);
+            size_t first, shown;
+            size_t matches = countWithPrefix(&workingIndex, input + 5, &first);
+            if (matches == 0) {
+                printf("Error: No entry starts with %s\n", input + 5);
+                continue;
             }
+
+            // Goes straight into the directory when it is the only match
+            if (matches == 1 && workingIndex.entries[first].isDirectory) {
+                if (SetCurrentDirectory(workingIndex.entries[first].name)) {
+                    enterDirectory(currentPath, sizeof(currentPath));
+                } else {
+                    printf("Error: Could not change directory to %s\n", workingIndex.entries[first].name);
+                }
+                continue;
+            }
+
+            // Otherwise lists a page of the directory starting at the first match
+            size_t end = printEntries(&workingIndex, first, workingIndex.count, NULL, JUMP_PAGE_SIZE, &shown);
+            setColour(COLOUR_INFO);
+            printf("Entries %lu to %lu of %lu shown, %lu start with \"%s\".\n", (unsigned long)(first + 1),
+                   (unsigned long)end, (unsigned long)workingIndex.count, (unsigned long)matches, input + 5);
+            setColour(COLOUR_DEFAULT);
+            continue;
+        }
+
+        const DirectoryEntry *entry = findEntry(&workingIndex, input);
+        if (entry && !entry->isDirectory) {
+            printf("%s is a file, not a directory.\n", entry->name);
+            continue;
+        }
+
+        if (SetCurrentDirectory(entry ? entry->name : input)) { // Attempt to change to given subdirectory
+            enterDirectory(currentPath, sizeof(currentPath));
         } else {
             printf("Error: Could not change directory to %s\n", input);
         }
@@ -524,10 +1695,11 @@ void printHelp() {
     printf("\nHelp Menu:\n");
     setColour(COLOUR_DEFAULT);
     printf("This program has the following features:\n");
-    printf("1. File Operations: Create, Copy, Delete, Rename, and View Files.\n");
-    printf("2. Line Operations: Append, Delete, Insert, and View Lines.\n");
-    printf("3. General Operations: View Changelog, Directory Listing, and Help.\n");
-    printf("4. Directory Management: Navigate directories and list contents.\n");
+    printf("1. File Operations: Create, Copy, Delete, Rename, View, Follow and Normalize Files.\n");
+    printf("2. Line Operations: Append, Delete, Insert, View Lines and File Statistics.\n");
+    printf("3. General Operations: View or Follow Changelog, Directory Listing, and Help.\n");
+    printf("4. Directory Management: Navigate directories and list or filter contents.\n");
+    printf("Tip: press Tab while typing a file or directory name to complete it.\n");
 }
 
 // Function to handle user inpt and program navigation
@@ -543,8 +1715,9 @@ void mainMenu() {
         printf("2. Line Operations\n");
         printf("3. Directory Listing\n");
         printf("4. View Change Log\n");
-        printf("5. Help Menu\n");
-        printf("6. Quit\n");
+        printf("5. Follow Change Log\n");
+        printf("6. Help Menu\n");
+        printf("7. Quit\n");
         printf("Enter your Choice: ");
         scanf("%d", &choice); // gets the users choice
 
@@ -563,64 +1736,55 @@ void mainMenu() {
                     printf("3. Copy File\n");
                     printf("4. Rename File\n");
                     printf("5. Show File Contents\n");
-                    printf("6. Back to Main Menu\n");
+                    printf("6. Normalize Line Endings / Check UTF-8\n");
+                    printf("7. Follow File (live tail)\n");
+                    printf("8. Back to Main Menu\n");
                     printf("Enter your choice: ");
                     scanf("%d", &fileChoice);
 
                     // Clear the newline left by scanf
                     while(getchar() != '\n');
 
-                    if (fileChoice == 6) break;
+                    if (fileChoice == 8) break;
 
                     switch (fileChoice) {
                         case 1: //create
-                        printf("Enter the name of the file to create: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to create: ", filename, sizeof(filename));
                         createFile(filename);
                         break;
                         
                         case 2: //delete
-                        printf("Enter the name of the file to delete: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to delete: ", filename, sizeof(filename));
                         deleteFile(filename);
                         break;
 
                         case 3: //copy
-                        printf("Enter the name of the source file: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
-                        printf("Enter the name of the destination file: ");
-                        fgets(destination, sizeof(destination), stdin);
-                        destination[strcspn(destination, "\n")] = 0;  
-                        appendTxtExtension(destination);
+                        readFileName("Enter the name of the source file: ", filename, sizeof(filename));
+                        readFileName("Enter the name of the destination file: ", destination, sizeof(destination));
                         copyFile(filename, destination);
                         break;
 
                         case 4: //rename
-                        printf("Enter the current file name: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
-                        printf("Enter the new file name: ");
-                        fgets(newName, sizeof(newName), stdin);
-                        newName[strcspn(newName, "\n")] = 0;  
-                        appendTxtExtension(newName);
+                        readFileName("Enter the current file name: ", filename, sizeof(filename));
+                        readFileName("Enter the new file name: ", newName, sizeof(newName));
                         renameFile(filename, newName);
                         break;
 
                         case 5: //show contents
-                        printf("Enter the name of the file to display: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to display: ", filename, sizeof(filename));
                         printFileContents(filename);
                         break;
 
+                        case 6: //normalize
+                        readFileName("Enter the name of the file to normalize: ", filename, sizeof(filename));
+                        normalizeFile(filename);
+                        break;
+
+                        case 7: //follow
+                        readFileName("Enter the name of the file to follow: ", filename, sizeof(filename));
+                        followFile(filename);
+                        break;
+
                         default:
                         setColour(COLOUR_ERROR);
                         printf("Invalid Choice. Please try Again.\n");
@@ -640,55 +1804,46 @@ void mainMenu() {
                     printf("3. Insert Line\n");
                     printf("4. Show Specific Line\n");
                     printf("5. Count Lines in File\n");
-                    printf("6. Back to Main Menu\n");
+                    printf("6. File Statistics\n");
+                    printf("7. Back to Main Menu\n");
                     printf("Enter your choice: ");
                     scanf("%d", &lineChoice);
 
                     // Clear the newline left by scanf
                     while(getchar() != '\n');
 
-                    if (lineChoice == 6) break;
+                    if (lineChoice == 7) break;
 
                     switch (lineChoice) {
                         case 1: //append
-                        printf("Enter the name of the file to append a line: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to append a line: ", filename, sizeof(filename));
                         appendLineToFile(filename);
                         break;
                         
                         case 2: //delete
-                        printf("Enter the name of the file to delete a line: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to delete a line: ", filename, sizeof(filename));
                         deleteLine(filename);
                         break;
 
                         case 3: //insert
-                        printf("Enter the name of the file to insert a line: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to insert a line: ", filename, sizeof(filename));
                         insertLine(filename);
                         break;
 
                         case 4: //Show specific line
-                        printf("Enter the name of the file to show a specific line: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to show a specific line: ", filename, sizeof(filename));
                         printLine(filename);
                         break;
 
                         case 5: //count lines
-                        printf("Enter the name of the file to count the number of lines: ");
-                        fgets(filename, sizeof(filename), stdin);
-                        filename[strcspn(filename, "\n")] = 0;  
-                        appendTxtExtension(filename);
+                        readFileName("Enter the name of the file to count the number of lines: ", filename, sizeof(filename));
                         printf("Total Lines in %s: %d\n", filename, countLines(filename));
                         break;
+
+                        case 6: //statistics
+                        readFileName("Enter the name of the file to show statistics for: ", filename, sizeof(filename));
+                        printFileStatistics(filename);
+                        break;
                         
                         default:
                         setColour(COLOUR_ERROR);
@@ -712,11 +1867,21 @@ void mainMenu() {
             }
             break;
 
-            case 5: // show the help menu
+            case 5: // follow changelog
+            {
+                char logPath[MAX_PATH];
+                getExecutableDirectory(logPath, sizeof(logPath));
+                strcat(logPath, "\\changelog.txt");
+
+                followFile(logPath);
+            }
+            break;
+
+            case 6: // show the help menu
             printHelp();
             break;
 
-            case 6: // exit program
+            case 7: // exit program
             setColour(COLOUR_SUCCESS);
             printf("Exiting program...\n");
             setColour(COLOUR_DEFAULT);